@@ -0,0 +1,26 @@
+#pragma once
+
+namespace critical_section {
+
+// Masks interrupts around the timing critical parts of a bus transaction.
+// Enter() and Exit() are always called in pairs and never nested.
+class ICriticalSection {
+
+public:
+
+    virtual void Enter(void) = 0;
+    virtual void Exit(void) = 0;
+
+};
+
+// Default policy, leaves interrupts untouched.
+class NoCriticalSection : public ICriticalSection {
+
+public:
+
+    virtual void Enter(void) {}
+    virtual void Exit(void) {}
+
+};
+
+} /* namespace critical_section */
@@ -2,12 +2,28 @@
 
 namespace one_wire_driver {
 
+critical_section::NoCriticalSection OneWireDriver::no_critical_section_;
+
 OneWireDriver::OneWireDriver(
         gpio_driver::IGpio&     gpio,
         iwait::IWait&           wait)
     :
         gpio_(gpio),
-        wait_(wait)
+        wait_(wait),
+        critical_section_(no_critical_section_)
+{
+    // By default set line to high state.
+    gpio_.Set();
+}
+
+OneWireDriver::OneWireDriver(
+        gpio_driver::IGpio&                 gpio,
+        iwait::IWait&                       wait,
+        critical_section::ICriticalSection& critical_section)
+    :
+        gpio_(gpio),
+        wait_(wait),
+        critical_section_(critical_section)
 {
     // By default set line to high state.
     gpio_.Set();
@@ -19,11 +35,15 @@ uint8_t OneWireDriver::Reset(void) {
 
     gpio_.Clear();
     wait_.wait_us(480);
+
+    // Presence pulse must be sampled before the slave releases the line.
+    critical_section_.Enter();
     gpio_.Set();
     wait_.wait_us(65);
 
     // if received low state then slave is present.
     is_present = (gpio_.GetState() == 0);
+    critical_section_.Exit();
 
     wait_.wait_us(480);
 
@@ -62,26 +82,43 @@ void OneWireDriver::SendAndGet(uint8_t send_buff[], uint8_t recv_buff[], uint16_
 void OneWireDriver::SendBit(uint8_t bit) {
     this->gpio_.Set();
     this->wait_.wait_us(2);
+
+    // Interrupts are masked only while the line is held low, so an ISR
+    // can not stretch the pulse of a "1" into a "0".
+    this->critical_section_.Enter();
     this->gpio_.Clear();
     this->wait_.wait_us(2);
 
-    if (bit)
+    if (bit) {
         this->gpio_.Set();
-
-    this->wait_.wait_us(80);
-    this->gpio_.Set();
+        this->critical_section_.Exit();
+        this->wait_.wait_us(80);
+        this->gpio_.Set();
+    } else {
+        this->wait_.wait_us(80);
+        this->gpio_.Set();
+        this->critical_section_.Exit();
+    }
 }
 
 uint8_t OneWireDriver::GetBit(void) {
 
+    uint8_t state = 0;
+
     this->gpio_.Set();
     this->wait_.wait_us(2);
+
+    // Line has to be sampled within 15us from the falling edge.
+    this->critical_section_.Enter();
     this->gpio_.Clear();
     this->wait_.wait_us(2);
     this->gpio_.Set();
     this->wait_.wait_us(4);
 
-    return (this->gpio_.GetState() != 0);
+    state = (this->gpio_.GetState() != 0);
+    this->critical_section_.Exit();
+
+    return state;
 }
 
 
@@ -3,6 +3,7 @@
 #include "ITransport.h"
 #include "IGpioDriver.h"
 #include "IWait.h"
+#include "ICriticalSection.h"
 
 namespace one_wire_driver {
 
@@ -14,6 +15,11 @@ public:
             gpio_driver::IGpio&     gpio,
             iwait::IWait&           wait);
 
+    OneWireDriver(
+            gpio_driver::IGpio&                 gpio,
+            iwait::IWait&                       wait,
+            critical_section::ICriticalSection& critical_section);
+
     virtual uint8_t Reset(void);
     virtual void Send(uint8_t send_buff[], uint16_t size);
     virtual void Get(uint8_t recv_buff[], uint16_t size);
@@ -22,6 +28,9 @@ public:
 private:
     gpio_driver::IGpio&     gpio_;
     iwait::IWait&           wait_;
+    critical_section::ICriticalSection& critical_section_;
+
+    static critical_section::NoCriticalSection no_critical_section_;
 
     void SendBit(uint8_t bit);
     uint8_t GetBit(void);
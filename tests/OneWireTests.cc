@@ -21,6 +21,7 @@ enum DataType {
     TYPE_TIME_US = 0,
     TYPE_TIME_MS,
     TYPE_GPIO,
+    TYPE_CRITICAL_SECTION,
 };
 
 class TestStruct {
@@ -68,6 +69,27 @@ public:
     virtual void wait_ms(uint16_t time) { received_data.push_back(std::unique_ptr<TestStruct>(new TestStruct(TYPE_TIME_MS, time))); }
 };
 
+class OneWireCriticalSectionMock : public critical_section::ICriticalSection {
+
+public:
+
+    OneWireCriticalSectionMock() : entered_(false) {}
+
+    virtual void Enter(void) {
+        assert(!entered_);
+        entered_ = true;
+        received_data.push_back(std::unique_ptr<TestStruct>(new TestStruct(TYPE_CRITICAL_SECTION, 1)));
+    }
+
+    virtual void Exit(void) {
+        assert(entered_);
+        entered_ = false;
+        received_data.push_back(std::unique_ptr<TestStruct>(new TestStruct(TYPE_CRITICAL_SECTION, 0)));
+    }
+
+    bool entered_;
+};
+
 TEST(OneWireDriver, Reset_Slave_not_present) {
 
     std::vector<TestStruct> expected {
@@ -532,4 +554,201 @@ TEST(OneWireDriver, GetData) {
                 << " at position:" << i << std::endl;
 }
 
+TEST(OneWireDriver, Reset_CriticalSection) {
+
+    std::vector<TestStruct> expected {
+        TestStruct(TYPE_GPIO, 1),
+        TestStruct(TYPE_GPIO, 0),
+        TestStruct(TYPE_TIME_US, 480),
+        TestStruct(TYPE_CRITICAL_SECTION, 1),
+        TestStruct(TYPE_GPIO, 1),
+        TestStruct(TYPE_TIME_US, 65),
+        TestStruct(TYPE_CRITICAL_SECTION, 0),
+        TestStruct(TYPE_TIME_US, 480)
+    };
+
+    std::vector<uint8_t> get_state { 0 };
+
+    OneWireWaitMock wait;
+    OneWireGpioMock gpio(get_state);
+    OneWireCriticalSectionMock critical_section;
+
+    received_data.clear();
+
+    one_wire_driver::OneWireDriver one_wire(
+            gpio,
+            wait,
+            critical_section);
+
+    uint8_t is_present = one_wire.Reset();
+
+    EXPECT_TRUE(is_present == 1);
+    EXPECT_FALSE(critical_section.entered_);
+
+    EXPECT_TRUE(expected.size() == received_data.size())                \
+            << "expected.size()=" << expected.size()                    \
+            << " != received_data.size()=" << received_data.size()      \
+            << std::endl;
+
+    for (int i = 0 ; i < expected.size() && i < received_data.size(); i++) {
+        EXPECT_TRUE(expected[i].value_ == received_data[i]->value_)     \
+            << "Value exp=" << expected[i].value_                       \
+            << " != recv= " << received_data[i]->value_                 \
+            << " at position: " << i << std::endl;
+
+        EXPECT_TRUE(expected[i].type_ == received_data[i]->type_)       \
+            << "Type exp=" << expected[i].type_                         \
+            << " != recv= " << received_data[i]->type_                  \
+            << " at position: " << i << std::endl;
+    }
+}
+
+TEST(OneWireDriver, SendData_CriticalSection) {
+
+    std::vector<TestStruct> expected {
+        TestStruct(TYPE_GPIO, 1),
+
+                                                                // Byte 0x02
+                                                                // 0b 0000 0010
+                                                                //
+        TestStruct(TYPE_GPIO, 1),                               // LSB (0)
+        TestStruct(TYPE_TIME_US, SEND_BIT_SET_US_TIME),         //
+        TestStruct(TYPE_CRITICAL_SECTION, 1),                   // Masked until
+        TestStruct(TYPE_GPIO, 0),                               // end of low pulse
+        TestStruct(TYPE_TIME_US, SEND_BIT_CLEAR_US_TIME),       //
+        TestStruct(TYPE_TIME_US, SEND_BIT_WAIT_TO_END),         //
+        TestStruct(TYPE_GPIO, 1),                               //
+        TestStruct(TYPE_CRITICAL_SECTION, 0),                   //
+        TestStruct(TYPE_TIME_US, SEND_BIT_WAIT_TO_NEXT_BIT),    //
+
+        TestStruct(TYPE_GPIO, 1),                               // (1)
+        TestStruct(TYPE_TIME_US, SEND_BIT_SET_US_TIME),         //
+        TestStruct(TYPE_CRITICAL_SECTION, 1),                   // Masked only
+        TestStruct(TYPE_GPIO, 0),                               // for the short
+        TestStruct(TYPE_TIME_US, SEND_BIT_CLEAR_US_TIME),       // low pulse
+        TestStruct(TYPE_GPIO, 1),                               //
+        TestStruct(TYPE_CRITICAL_SECTION, 0),                   //
+        TestStruct(TYPE_TIME_US, SEND_BIT_WAIT_TO_END),         //
+        TestStruct(TYPE_GPIO, 1),                               //
+        TestStruct(TYPE_TIME_US, SEND_BIT_WAIT_TO_NEXT_BIT),    //
+    };
+
+    // Remaining six bits are "0".
+    for (int bit = 2; bit < 8; bit++) {
+        expected.push_back(TestStruct(TYPE_GPIO, 1));
+        expected.push_back(TestStruct(TYPE_TIME_US, SEND_BIT_SET_US_TIME));
+        expected.push_back(TestStruct(TYPE_CRITICAL_SECTION, 1));
+        expected.push_back(TestStruct(TYPE_GPIO, 0));
+        expected.push_back(TestStruct(TYPE_TIME_US, SEND_BIT_CLEAR_US_TIME));
+        expected.push_back(TestStruct(TYPE_TIME_US, SEND_BIT_WAIT_TO_END));
+        expected.push_back(TestStruct(TYPE_GPIO, 1));
+        expected.push_back(TestStruct(TYPE_CRITICAL_SECTION, 0));
+        expected.push_back(TestStruct(TYPE_TIME_US, SEND_BIT_WAIT_TO_NEXT_BIT));
+    }
+
+    expected.push_back(TestStruct(TYPE_TIME_US, SEND_BYTE_WAIT_TO_NEXT_BYTE));
+
+    std::vector<uint8_t> get_state;
+
+    OneWireWaitMock wait;
+    OneWireGpioMock gpio(get_state);
+    OneWireCriticalSectionMock critical_section;
+
+    received_data.clear();
+
+    one_wire_driver::OneWireDriver one_wire(
+            gpio,
+            wait,
+            critical_section);
+
+    uint8_t one_wire_send[] = { 0x02 };
+
+    one_wire.Send(one_wire_send, sizeof(one_wire_send));
+
+    EXPECT_FALSE(critical_section.entered_);
+
+    EXPECT_TRUE(expected.size() == received_data.size())            \
+            << "expected.size()=" << expected.size()                \
+            << " != received_data.size()=" << received_data.size()  \
+            << std::endl;
+
+    for (int i = 0; i < expected.size() && i < received_data.size(); i++) {
+        EXPECT_TRUE(expected[i].value_ == received_data[i]->value_) \
+            << "Value exp=" << expected[i].value_                   \
+            << " != recv=" << received_data[i]->value_              \
+            << " at position: " << i << std::endl;
+
+        EXPECT_TRUE(expected[i].type_ == received_data[i]->type_)   \
+            << "Type exp=" << expected[i].type_                     \
+            << " != recv=" << received_data[i]->type_               \
+            << " at position: " << i << std::endl;
+    }
+}
+
+TEST(OneWireDriver, GetData_CriticalSection) {
+
+    std::vector<TestStruct> expected {
+        TestStruct(TYPE_GPIO, 1),
+    };
+
+    for (int bit = 0; bit < 8; bit++) {
+        expected.push_back(TestStruct(TYPE_GPIO, 1));
+        expected.push_back(TestStruct(TYPE_TIME_US, GET_BIT_RESET_US_TIME));
+        expected.push_back(TestStruct(TYPE_CRITICAL_SECTION, 1));   // Masked from falling
+        expected.push_back(TestStruct(TYPE_GPIO, 0));               // edge until sample
+        expected.push_back(TestStruct(TYPE_TIME_US, GET_BIT_CLEAR_US_TIME));
+        expected.push_back(TestStruct(TYPE_GPIO, 1));
+        expected.push_back(TestStruct(TYPE_TIME_US, GET_BIT_WAIT_TO_READ_US_TIME));
+        expected.push_back(TestStruct(TYPE_CRITICAL_SECTION, 0));
+        expected.push_back(TestStruct(TYPE_TIME_US, GET_BIT_WAIT_TO_NEXT_BIT));
+    }
+
+    expected.push_back(TestStruct(TYPE_TIME_US, GET_BYTE_WAIT_TO_NEXT_BYTE));
+
+    std::vector<uint8_t> get_state {
+        // Get back 0x29
+        // 0b0010 1001
+        1, 0, 0, 1, 0, 1, 0, 0
+    };
+
+    std::reverse(get_state.begin(), get_state.end());
+
+    OneWireWaitMock wait;
+    OneWireGpioMock gpio(get_state);
+    OneWireCriticalSectionMock critical_section;
+
+    received_data.clear();
+
+    one_wire_driver::OneWireDriver one_wire(
+            gpio,
+            wait,
+            critical_section);
+
+    uint8_t one_wire_get[1] = { 0x00 };
+
+    one_wire.Get(one_wire_get, sizeof(one_wire_get));
+
+    EXPECT_FALSE(critical_section.entered_);
+    EXPECT_TRUE(one_wire_get[0] == 0x29)                            \
+            << "Expected=" << 0x29                                  \
+            << " Got=" << (int)one_wire_get[0] << std::endl;
+
+    EXPECT_TRUE(expected.size() == received_data.size())            \
+            << "expected.size()=" << expected.size()                \
+            << " != received_data.size()=" << received_data.size()  \
+            << std::endl;
+
+    for (int i = 0; i < expected.size() && i < received_data.size(); i++) {
+        EXPECT_TRUE(expected[i].value_ == received_data[i]->value_) \
+                << "Value exp=" << (int)expected[i].value_          \
+                << " != recv=" << (int)received_data[i]->value_     \
+                << " at position: " << i << std::endl;
+
+        EXPECT_TRUE(expected[i].type_ == received_data[i]->type_)   \
+                << "Type exp=" << expected[i].type_                 \
+                << " != recv=" << received_data[i]->type_           \
+                << " at position: " << i << std::endl;
+    }
+}
+
 } /* namespace test_OneWireDriver */